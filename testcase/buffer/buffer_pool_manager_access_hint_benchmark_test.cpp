@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+//                         BusTub
+//
+// buffer_pool_manager_access_hint_benchmark_test.cpp
+//
+// Identification: test/buffer/buffer_pool_manager_access_hint_benchmark_test.cpp
+//
+//===----------------------------------------------------------------------===//
+
+// Needs AccessType::IndexInternal, add it together with the rest of the AccessType extension described in
+// project_tips.md (Access-Priority Hints) before copying this file into bustub.
+
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "gtest/gtest.h"
+#include "storage/disk/disk_manager_memory.h"
+
+namespace bustub {
+
+// Counts the pages read from disk, so that the misses of the hot set can be told apart from the scan misses.
+class HintCountingDiskManager : public DiskManagerUnlimitedMemory {
+ public:
+  explicit HintCountingDiskManager(page_id_t hot_pages) : hot_pages_(hot_pages) {}
+
+  void ReadPage(page_id_t page_id, char *page_data) override {
+    if (page_id < hot_pages_) {
+      ++hot_reads_;
+    } else {
+      ++scan_reads_;
+    }
+    DiskManagerUnlimitedMemory::ReadPage(page_id, page_data);
+  }
+
+  void Reset() {
+    hot_reads_ = 0;
+    scan_reads_ = 0;
+  }
+
+  page_id_t hot_pages_;
+  std::atomic<size_t> hot_reads_{0};
+  std::atomic<size_t> scan_reads_{0};
+};
+
+// Same workload as buffer_pool_manager_scan_benchmark_test.cpp: each scan page is fetched once per tuple.
+const size_t HINT_SCAN_ACCESSES_PER_PAGE = 4;
+
+// Returns the hit ratio of the point lookups while a scan runs over the rest of the pages, with every fetch and unpin
+// tagged with the given access types.
+auto HintedPointLookupHitRatio(BufferPoolManager *bpm, HintCountingDiskManager *disk_manager, page_id_t num_pages,
+                               size_t num_lookups, AccessType scan_access_type, AccessType lookup_access_type)
+    -> double {
+  disk_manager->Reset();
+  std::atomic<bool> stop_scan{false};
+  std::thread scan_thread([bpm, disk_manager, num_pages, scan_access_type, &stop_scan]() {
+    while (!stop_scan) {
+      for (page_id_t page_id = disk_manager->hot_pages_; page_id < num_pages && !stop_scan; page_id++) {
+        for (size_t i = 0; i < HINT_SCAN_ACCESSES_PER_PAGE; i++) {
+          if (bpm->FetchPage(page_id, scan_access_type) != nullptr) {
+            bpm->UnpinPage(page_id, false, scan_access_type);
+          }
+        }
+      }
+    }
+  });
+
+  std::default_random_engine rng(0);
+  std::uniform_int_distribution<page_id_t> dist(0, disk_manager->hot_pages_ - 1);
+  for (size_t i = 0; i < num_lookups; i++) {
+    auto page_id = dist(rng);
+    auto *page = bpm->FetchPage(page_id, lookup_access_type);
+    EXPECT_NE(nullptr, page);
+    if (page != nullptr) {
+      bpm->UnpinPage(page_id, false, lookup_access_type);
+    }
+  }
+
+  stop_scan = true;
+  scan_thread.join();
+  return 1.0 - static_cast<double>(disk_manager->hot_reads_) / num_lookups;
+}
+
+TEST(BufferPoolManagerAccessHintBenchmark, PointLookupWithHintedScan) {  // NOLINT
+  const size_t buffer_pool_size = 64;
+  const size_t k = 2;
+  const page_id_t hot_pages = 48;
+  const page_id_t num_pages = 4096;
+  const size_t num_lookups = 200000;
+
+  auto disk_manager = std::make_unique<HintCountingDiskManager>(hot_pages);
+  auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager.get(), k);
+
+  page_id_t page_id_temp;
+  for (page_id_t i = 0; i < num_pages; i++) {
+    ASSERT_NE(nullptr, bpm->NewPage(&page_id_temp));
+    ASSERT_TRUE(bpm->UnpinPage(page_id_temp, true));
+  }
+  bpm->FlushAllPages();
+
+  std::cout << "<<< BEGIN" << std::endl;
+  auto hit_ratio = HintedPointLookupHitRatio(bpm.get(), disk_manager.get(), num_pages, num_lookups,
+                                             AccessType::Unknown, AccessType::Unknown);
+  std::cout << "Point lookup hit ratio with concurrent scan (no hints): " << hit_ratio << std::endl;
+  std::cout << "Scan pages read: " << disk_manager->scan_reads_ << std::endl;
+  hit_ratio = HintedPointLookupHitRatio(bpm.get(), disk_manager.get(), num_pages, num_lookups, AccessType::Scan,
+                                        AccessType::IndexInternal);
+  std::cout << "Point lookup hit ratio with concurrent scan (Scan / IndexInternal hints): " << hit_ratio << std::endl;
+  std::cout << "Scan pages read: " << disk_manager->scan_reads_ << std::endl;
+  std::cout << ">>> END" << std::endl;
+
+  disk_manager->ShutDown();
+}
+
+}  // namespace bustub
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+//                         BusTub
+//
+// buffer_pool_manager_flush_benchmark_test.cpp
+//
+// Identification: test/buffer/buffer_pool_manager_flush_benchmark_test.cpp
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "gtest/gtest.h"
+
+namespace bustub {
+
+// Dirties every page in the pool, then measures how long the flush takes.
+auto FlushBenchmarkCall(BufferPoolManager *bpm, const std::vector<page_id_t> &page_ids,
+                        const std::function<void()> &flush) -> size_t {
+  for (auto page_id : page_ids) {
+    auto *page = bpm->FetchPage(page_id);
+    EXPECT_NE(nullptr, page);
+    ++page->GetData()[0];
+    bpm->UnpinPage(page_id, true);
+  }
+  auto clock_start = std::chrono::system_clock::now();
+  flush();
+  auto clock_end = std::chrono::system_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(clock_end - clock_start).count();
+}
+
+TEST(BufferPoolManagerFlushBenchmark, DirtyPageFlushBenchmark) {  // NOLINT
+  const std::string db_name = "test.db";
+  const size_t num_pages = 10000;
+  const size_t k = 2;
+
+  remove(db_name.c_str());
+  auto *disk_manager = new DiskManager(db_name);
+
+  // Create the pages through a small pool, so that they are written to disk by evictions.
+  std::vector<page_id_t> page_ids;
+  page_id_t page_id_temp;
+  auto *create_bpm = new BufferPoolManager(64, disk_manager, k);
+  for (size_t i = 0; i < num_pages; i++) {
+    ASSERT_NE(nullptr, create_bpm->NewPage(&page_id_temp));
+    create_bpm->UnpinPage(page_id_temp, true);
+    page_ids.push_back(page_id_temp);
+  }
+  create_bpm->FlushAllPages();
+  delete create_bpm;
+
+  // Load them into a pool that holds all of them in shuffled order, so that frame order is no longer page id order,
+  // which is what a pool looks like after running for a while.
+  std::vector<page_id_t> shuffled_page_ids = page_ids;
+  std::shuffle(shuffled_page_ids.begin(), shuffled_page_ids.end(), std::default_random_engine{});
+  auto *bpm = new BufferPoolManager(num_pages, disk_manager, k);
+  for (auto page_id : shuffled_page_ids) {
+    ASSERT_NE(nullptr, bpm->FetchPage(page_id));
+    bpm->UnpinPage(page_id, false);
+  }
+
+  std::cout << "<<< BEGIN" << std::endl;
+  auto ms = FlushBenchmarkCall(bpm, page_ids, [bpm]() { bpm->FlushAllPages(); });
+  std::cout << "FlushAllPages (frame order): " << ms << "ms" << std::endl;
+  ms = FlushBenchmarkCall(bpm, page_ids, [bpm, &shuffled_page_ids]() {
+    for (auto page_id : shuffled_page_ids) {
+      bpm->FlushPage(page_id);
+    }
+  });
+  std::cout << "FlushPage in random page order: " << ms << "ms" << std::endl;
+  ms = FlushBenchmarkCall(bpm, page_ids, [bpm, &page_ids]() {
+    for (auto page_id : page_ids) {
+      bpm->FlushPage(page_id);
+    }
+  });
+  std::cout << "FlushPage in page id order: " << ms << "ms" << std::endl;
+  std::cout << ">>> END" << std::endl;
+
+  disk_manager->ShutDown();
+  remove(db_name.c_str());
+  remove("test.log");
+
+  delete bpm;
+  delete disk_manager;
+}
+
+}  // namespace bustub
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+//                         BusTub
+//
+// buffer_pool_manager_hit_benchmark_test.cpp
+//
+// Identification: test/buffer/buffer_pool_manager_hit_benchmark_test.cpp
+//
+//===----------------------------------------------------------------------===//
+
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "gtest/gtest.h"
+#include "storage/disk/disk_manager_memory.h"
+
+namespace bustub {
+
+// Every page fits in the pool, so all fetches issued by the worker threads are buffer hits.
+auto BufferPoolHitBenchmarkCall(BufferPoolManager *bpm, size_t num_pages, size_t num_threads, size_t fetches_per_thread)
+    -> size_t {
+  std::vector<std::thread> threads;
+  auto clock_start = std::chrono::system_clock::now();
+  for (size_t i = 0; i < num_threads; i++) {
+    threads.emplace_back([bpm, num_pages, fetches_per_thread, i]() {
+      std::default_random_engine rng(i);
+      std::uniform_int_distribution<page_id_t> dist(0, static_cast<page_id_t>(num_pages) - 1);
+      for (size_t j = 0; j < fetches_per_thread; j++) {
+        auto guard = bpm->FetchPageRead(dist(rng));
+        EXPECT_NE(nullptr, guard.GetData());
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto clock_end = std::chrono::system_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(clock_end - clock_start).count();
+}
+
+TEST(BufferPoolManagerHitBenchmark, HitHeavyBenchmark) {  // NOLINT
+  const size_t buffer_pool_size = 64;
+  const size_t k = 2;
+  const size_t total_fetches = 1 << 20;
+
+  auto disk_manager = std::make_unique<DiskManagerUnlimitedMemory>();
+  auto bpm = std::make_unique<BufferPoolManager>(buffer_pool_size, disk_manager.get(), k);
+
+  page_id_t page_id_temp;
+  for (size_t i = 0; i < buffer_pool_size; i++) {
+    ASSERT_NE(nullptr, bpm->NewPage(&page_id_temp));
+    ASSERT_TRUE(bpm->UnpinPage(page_id_temp, false));
+  }
+
+  std::cout << "<<< BEGIN" << std::endl;
+  size_t single_thread_ms = 0;
+  for (size_t num_threads : {1, 2, 4, 8, 16, 32}) {
+    auto ms = BufferPoolHitBenchmarkCall(bpm.get(), buffer_pool_size, num_threads, total_fetches / num_threads);
+    if (num_threads == 1) {
+      single_thread_ms = ms;
+    }
+    std::cout << "threads: " << num_threads << " time: " << ms << "ms";
+    if (ms != 0) {
+      std::cout << " speedup: " << static_cast<double>(single_thread_ms) / ms;
+    }
+    std::cout << std::endl;
+  }
+  std::cout << ">>> END" << std::endl;
+
+  for (size_t i = 0; i < buffer_pool_size; i++) {
+    auto *page = bpm->FetchPage(static_cast<page_id_t>(i));
+    ASSERT_NE(nullptr, page);
+    EXPECT_EQ(1, page->GetPinCount());
+    bpm->UnpinPage(page->GetPageId(), false);
+  }
+  disk_manager->ShutDown();
+}
+
+}  // namespace bustub
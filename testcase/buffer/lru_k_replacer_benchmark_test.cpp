@@ -0,0 +1,71 @@
+/**
+ * lru_k_replacer_benchmark_test.cpp
+ */
+
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "buffer/lru_k_replacer.h"
+#include "gtest/gtest.h"
+
+namespace bustub {
+
+// Simulates a full buffer pool: every operation evicts one frame and reuses it for a new page. Only a few frames start
+// with fewer than k accesses (+inf k-distance), so they are drained after the first operations whatever num_frames
+// is. From then on the victims alternate between being re-recorded k times and once: every other operation evicts the
+// single +inf frame left by the previous one, the rest evict from the frames ordered by their k-th most recent access.
+auto LRUKReplacerBenchmarkCall(size_t num_frames, size_t k, size_t num_ops) -> double {
+  const size_t num_inf_frames = 64;
+  LRUKReplacer lru_replacer(num_frames, k);
+  std::default_random_engine rng(0);
+  std::uniform_int_distribution<frame_id_t> dist(0, static_cast<frame_id_t>(num_frames) - 1);
+
+  for (size_t i = 0; i < num_frames; i++) {
+    auto frame_id = static_cast<frame_id_t>(i);
+    size_t accesses = i < num_inf_frames ? 1 : k;
+    for (size_t j = 0; j < accesses; j++) {
+      lru_replacer.RecordAccess(frame_id);
+    }
+    lru_replacer.SetEvictable(frame_id, true);
+  }
+
+  auto clock_start = std::chrono::system_clock::now();
+  for (size_t i = 0; i < num_ops; i++) {
+    // a hit on a random frame
+    auto hit_frame = dist(rng);
+    lru_replacer.SetEvictable(hit_frame, false);
+    lru_replacer.RecordAccess(hit_frame);
+    lru_replacer.SetEvictable(hit_frame, true);
+
+    // a miss that needs a victim
+    frame_id_t victim;
+    EXPECT_TRUE(lru_replacer.Evict(&victim));
+    size_t accesses = i % 2 == 0 ? k : 1;
+    for (size_t j = 0; j < accesses; j++) {
+      lru_replacer.RecordAccess(victim);
+    }
+    lru_replacer.SetEvictable(victim, true);
+  }
+  auto clock_end = std::chrono::system_clock::now();
+  EXPECT_EQ(num_frames, lru_replacer.Size());
+
+  auto dur = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_end - clock_start);
+  return static_cast<double>(dur.count()) / num_ops;
+}
+
+TEST(LRUKReplacerBenchmark, ReplacerSizeBenchmark) {  // NOLINT
+  const size_t k = 2;
+  const size_t num_ops = 10000;
+
+  std::cout << "<<< BEGIN" << std::endl;
+  for (size_t num_frames : {1000, 10000, 100000}) {
+    auto ns_per_op = LRUKReplacerBenchmarkCall(num_frames, k, num_ops);
+    std::cout << "frames: " << num_frames << " ns/op: " << ns_per_op << std::endl;
+  }
+  std::cout << ">>> END" << std::endl;
+}
+
+}  // namespace bustub
@@ -0,0 +1,176 @@
+/**
+ * replacer_trace_benchmark_test.cpp
+ */
+
+#include <algorithm>
+#include <chrono>  // NOLINT
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "buffer/lru_k_replacer.h"
+#include "buffer/lru_replacer.h"
+#include "gtest/gtest.h"
+
+namespace bustub {
+
+/*
+ * Every replacer is driven through the same three calls, the way a buffer pool would use it for pages that are
+ * unpinned right after each access:
+ *   Hit(frame_id)     the page in frame_id is accessed again
+ *   Admit(frame_id)   a new page has been read into frame_id
+ *   Evict(&frame_id)  pick a victim
+ * A new policy only needs an adapter to show up in the benchmark.
+ */
+class LRUKReplacerAdapter {
+ public:
+  explicit LRUKReplacerAdapter(size_t num_frames) : replacer_(num_frames, 2) {}
+  void Hit(frame_id_t frame_id) { replacer_.RecordAccess(frame_id); }
+  void Admit(frame_id_t frame_id) {
+    replacer_.RecordAccess(frame_id);
+    replacer_.SetEvictable(frame_id, true);
+  }
+  auto Evict(frame_id_t *frame_id) -> bool { return replacer_.Evict(frame_id); }
+
+ private:
+  LRUKReplacer replacer_;
+};
+
+// Adapts the Victim/Pin/Unpin interface: a hit pins and unpins the frame, which refreshes its position.
+template <typename Replacer>
+class PinUnpinReplacerAdapter {
+ public:
+  explicit PinUnpinReplacerAdapter(size_t num_frames) : replacer_(num_frames) {}
+  void Hit(frame_id_t frame_id) {
+    replacer_.Pin(frame_id);
+    replacer_.Unpin(frame_id);
+  }
+  void Admit(frame_id_t frame_id) { replacer_.Unpin(frame_id); }
+  auto Evict(frame_id_t *frame_id) -> bool { return replacer_.Victim(frame_id); }
+
+ private:
+  Replacer replacer_;
+};
+
+using LRUReplacerAdapter = PinUnpinReplacerAdapter<LRUReplacer>;
+// ClockReplacer is not implemented in this tree (ClockReplacerTest is disabled), its Victim always fails, so it is
+// left out until it is. Then it only needs: using ClockReplacerAdapter = PinUnpinReplacerAdapter<ClockReplacer>;
+
+struct TraceResult {
+  double hit_ratio_;
+  double ns_per_op_;
+};
+
+// Replays a page id trace against a pool of num_frames frames. Returns std::nullopt if the replacer fails to find a
+// victim while every frame is evictable.
+template <typename Adapter>
+auto ReplayTrace(const std::vector<page_id_t> &trace, size_t num_frames) -> std::optional<TraceResult> {
+  Adapter replacer(num_frames);
+  std::unordered_map<page_id_t, frame_id_t> page_table;
+  std::vector<page_id_t> frame_to_page(num_frames, INVALID_PAGE_ID);
+  size_t next_free_frame = 0;
+  size_t hits = 0;
+
+  auto clock_start = std::chrono::system_clock::now();
+  for (auto page_id : trace) {
+    auto iter = page_table.find(page_id);
+    if (iter != page_table.end()) {
+      hits++;
+      replacer.Hit(iter->second);
+      continue;
+    }
+    frame_id_t frame_id;
+    if (next_free_frame < num_frames) {
+      frame_id = static_cast<frame_id_t>(next_free_frame++);
+    } else {
+      if (!replacer.Evict(&frame_id)) {
+        ADD_FAILURE() << "no victim found with " << num_frames << " evictable frames";
+        return std::nullopt;
+      }
+      page_table.erase(frame_to_page[frame_id]);
+    }
+    page_table[page_id] = frame_id;
+    frame_to_page[frame_id] = page_id;
+    replacer.Admit(frame_id);
+  }
+  auto clock_end = std::chrono::system_clock::now();
+
+  auto dur = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_end - clock_start);
+  return TraceResult{static_cast<double>(hits) / trace.size(), static_cast<double>(dur.count()) / trace.size()};
+}
+
+// Point lookups where a few pages take most of the accesses.
+auto ZipfTrace(page_id_t num_pages, size_t length, double theta) -> std::vector<page_id_t> {
+  std::vector<double> cdf(num_pages);
+  double sum = 0;
+  for (page_id_t i = 0; i < num_pages; i++) {
+    sum += 1.0 / std::pow(i + 1, theta);
+    cdf[i] = sum;
+  }
+  std::default_random_engine rng(0);
+  std::uniform_real_distribution<double> dist(0, sum);
+  std::vector<page_id_t> trace;
+  for (size_t i = 0; i < length; i++) {
+    trace.push_back(static_cast<page_id_t>(std::lower_bound(cdf.begin(), cdf.end(), dist(rng)) - cdf.begin()));
+  }
+  return trace;
+}
+
+// Repeated full scans over a table larger than the pool.
+auto SequentialTrace(page_id_t num_pages, size_t length) -> std::vector<page_id_t> {
+  std::vector<page_id_t> trace;
+  for (size_t i = 0; i < length; i++) {
+    trace.push_back(static_cast<page_id_t>(i % num_pages));
+  }
+  return trace;
+}
+
+// Zipf point lookups interleaved with a scan over a separate range of pages.
+auto MixedTrace(page_id_t num_pages, size_t length, double theta) -> std::vector<page_id_t> {
+  auto lookups = ZipfTrace(num_pages, length / 2, theta);
+  auto scan = SequentialTrace(num_pages, length - lookups.size());
+  std::vector<page_id_t> trace;
+  for (size_t i = 0; i < length; i++) {
+    trace.push_back(i % 2 == 0 && i / 2 < lookups.size() ? lookups[i / 2] : num_pages + scan[i / 2]);
+  }
+  return trace;
+}
+
+template <typename Adapter>
+void PrintTraceResult(const std::string &policy, const std::string &trace_name, const std::vector<page_id_t> &trace,
+                      size_t num_frames) {
+  auto result = ReplayTrace<Adapter>(trace, num_frames);
+  if (!result.has_value()) {
+    return;
+  }
+  std::cout << "policy: " << policy << " trace: " << trace_name << " hit ratio: " << result->hit_ratio_
+            << " ns/op: " << result->ns_per_op_ << std::endl;
+}
+
+TEST(ReplacerTraceBenchmark, TraceReplayBenchmark) {  // NOLINT
+  const size_t num_frames = 256;
+  const page_id_t num_pages = 4096;
+  const size_t length = 200000;
+  const double theta = 0.99;
+
+  std::vector<std::pair<std::string, std::vector<page_id_t>>> traces = {
+      {"zipf", ZipfTrace(num_pages, length, theta)},
+      {"sequential", SequentialTrace(num_pages, length)},
+      {"mixed", MixedTrace(num_pages, length, theta)},
+  };
+
+  std::cout << "<<< BEGIN" << std::endl;
+  for (const auto &[trace_name, trace] : traces) {
+    PrintTraceResult<LRUKReplacerAdapter>("LRU-K(k=2)", trace_name, trace, num_frames);
+    PrintTraceResult<LRUReplacerAdapter>("LRU", trace_name, trace, num_frames);
+  }
+  std::cout << ">>> END" << std::endl;
+}
+
+}  // namespace bustub
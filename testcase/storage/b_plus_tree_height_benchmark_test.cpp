@@ -0,0 +1,119 @@
+/**
+ * b_plus_tree_height_benchmark_test.cpp
+ */
+
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "buffer/buffer_pool_manager.h"
+#include "gtest/gtest.h"
+#include "storage/disk/disk_manager_memory.h"
+#include "storage/index/b_plus_tree.h"
+#include "storage/page/b_plus_tree_internal_page.h"
+#include "storage/table/tuple.h"
+#include "test_util.h"  // NOLINT
+#include "type/value_factory.h"
+
+namespace bustub {
+
+// Walks down the leftmost path of the tree and returns the number of levels.
+template <size_t KeySize>
+auto BPlusTreeHeight(BufferPoolManager *bpm, page_id_t root_page_id) -> int {
+  using InternalPage = BPlusTreeInternalPage<GenericKey<KeySize>, page_id_t, GenericComparator<KeySize>>;
+  int height = 0;
+  page_id_t page_id = root_page_id;
+  while (page_id != INVALID_PAGE_ID) {
+    height++;
+    auto guard = bpm->FetchPageRead(page_id);
+    auto page = guard.template As<BPlusTreePage>();
+    if (page->IsLeafPage()) {
+      break;
+    }
+    page_id = guard.template As<InternalPage>()->ValueAt(0);
+  }
+  return height;
+}
+
+// Builds a composite key: the leading columns are shared by many keys (think tenant id, region, date), the last
+// column is unique. Keys stay in the same order as the integer they are built from.
+template <size_t KeySize>
+void SetBenchmarkKey(GenericKey<KeySize> *index_key, const Schema *key_schema, int64_t key) {
+  std::vector<Value> values;
+  auto column_count = static_cast<int64_t>(key_schema->GetColumnCount());
+  for (int64_t i = 0; i + 2 < column_count; i++) {
+    values.push_back(ValueFactory::GetBigIntValue(i + 1));
+  }
+  if (column_count >= 2) {
+    values.push_back(ValueFactory::GetBigIntValue(key / 1000));
+  }
+  values.push_back(ValueFactory::GetBigIntValue(key));
+  index_key->SetFromKey(Tuple(values, key_schema));
+}
+
+template <size_t KeySize>
+void BPlusTreeHeightBenchmarkCall(const std::string &key_schema_stmt, int64_t num_keys, size_t num_lookups) {
+  auto key_schema = ParseCreateStatement(key_schema_stmt);
+  GenericComparator<KeySize> comparator(key_schema.get());
+  auto disk_manager = std::make_unique<DiskManagerUnlimitedMemory>();
+  auto *bpm = new BufferPoolManager(1024, disk_manager.get());
+
+  page_id_t page_id;
+  auto *header_page = bpm->NewPage(&page_id);
+  (void)header_page;
+
+  // default leaf/internal max size, so that the fanout is decided by the page layout
+  BPlusTree<GenericKey<KeySize>, RID, GenericComparator<KeySize>> tree("foo_pk", page_id, bpm, comparator);
+  GenericKey<KeySize> index_key;
+  RID rid;
+  auto *transaction = new Transaction(0);
+
+  for (int64_t key = 0; key < num_keys; key++) {
+    rid.Set(static_cast<int32_t>(key >> 32), key & 0xFFFFFFFF);
+    SetBenchmarkKey(&index_key, key_schema.get(), key);
+    tree.Insert(index_key, rid, transaction);
+  }
+
+  std::default_random_engine rng(0);
+  std::uniform_int_distribution<int64_t> dist(0, num_keys - 1);
+  std::vector<RID> rids;
+  auto clock_start = std::chrono::system_clock::now();
+  for (size_t i = 0; i < num_lookups; i++) {
+    auto key = dist(rng);
+    rids.clear();
+    SetBenchmarkKey(&index_key, key_schema.get(), key);
+    tree.GetValue(index_key, &rids);
+    ASSERT_EQ(rids.size(), 1);
+    ASSERT_EQ(rids[0].GetSlotNum(), key & 0xFFFFFFFF);
+  }
+  auto clock_end = std::chrono::system_clock::now();
+  auto dur = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_end - clock_start);
+
+  std::cout << "key size: " << KeySize << " keys: " << num_keys
+            << " height: " << BPlusTreeHeight<KeySize>(bpm, tree.GetRootPageId())
+            << " lookup ns: " << static_cast<double>(dur.count()) / num_lookups << std::endl;
+
+  bpm->UnpinPage(HEADER_PAGE_ID, true);
+  delete transaction;
+  delete bpm;
+}
+
+// Takes minutes and a few GB of memory, run it explicitly with --gtest_also_run_disabled_tests.
+TEST(BPlusTreeHeightBenchmark, DISABLED_HeightAndLookupBenchmark) {  // NOLINT
+  const std::string short_key = "a bigint";
+  const std::string long_key = "a bigint, b bigint, c bigint, d bigint, e bigint, f bigint, g bigint, h bigint";
+
+  std::cout << "<<< BEGIN" << std::endl;
+  // heights are only comparable at the same key count
+  BPlusTreeHeightBenchmarkCall<8>(short_key, 1000000, 1000000);
+  BPlusTreeHeightBenchmarkCall<64>(long_key, 1000000, 1000000);
+  // a 64 byte key entry is 4.5x the size of an 8 byte one, 10M long keys do not fit the in-memory disk manager
+  BPlusTreeHeightBenchmarkCall<8>(short_key, 10000000, 1000000);
+  std::cout << ">>> END" << std::endl;
+}
+
+}  // namespace bustub